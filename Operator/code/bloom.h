@@ -0,0 +1,38 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "heapfile.h"
+
+
+// A blocked Bloom filter on attribute values.  Each value sets 8 bits
+// in one 32-byte block of the filter (one bit in each 32-bit word), so
+// adding or testing a value touches a single cache line.  The filter
+// answers "maybe" for every value added to it and "no" for most other
+// values.  Values that compare equal (0.0 and -0.0, strings that are
+// equal up to a null byte) are treated alike.
+
+class BloomFilter {
+ public:
+  BloomFilter(const int n,              // expected number of values
+              const Datatype type,      // type of the values
+              const int length);        // length of the values
+  ~BloomFilter();
+
+  void add(const char *attrPtr);        // add value at attrPtr
+  bool mayContain(const char *attrPtr) const; // was the value added?
+
+  int probes() const { return probeCnt; }   // number of calls to mayContain
+  int drops() const { return dropCnt; }     // ... that returned false
+
+ private:
+  unsigned long long hash(const char *attrPtr) const;
+
+  Datatype type;
+  int length;
+  unsigned int *blocks;                 // 8 words per block
+  unsigned int blockCnt;
+  mutable int probeCnt;
+  mutable int dropCnt;
+};
+
+#endif
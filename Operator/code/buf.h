@@ -105,6 +105,7 @@ private:
   BufHashTbl*    hashTable;  	// hash table mapping (File, page) to frame
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
+  pthread_mutex_t latch;	// serializes calls from concurrent scans
 
   const Status allocBuf(int & frame);   // allocate a free frame.  
   const void releaseBuf(int frame); // return unused frame to end of list
@@ -128,6 +129,13 @@ public:
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
+  const int getFreeBufs(); // number of frames no page is pinned in
+
+  const int getNumBufs() const // number of frames in the pool
+  {
+	return numBufs;
+  }
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
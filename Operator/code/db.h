@@ -2,6 +2,7 @@
 #define DB_H
 
 #include <sys/types.h>
+#include <pthread.h>
 #include <functional>
 #include "error.h"
 #include <string.h>
@@ -15,6 +16,16 @@ using namespace std;
 // forward class definition for db
 class DB;
 
+// LatchGuard holds a latch (mutex) for the lifetime of the guard, so
+// that the DB and BufMgr entry points can be called from the worker
+// threads of a parallel operator.
+class LatchGuard {
+  pthread_mutex_t& latch;
+ public:
+  LatchGuard(pthread_mutex_t& l) : latch(l) { pthread_mutex_lock(&latch); }
+  ~LatchGuard() { pthread_mutex_unlock(&latch); }
+};
+
 // class definition for open files
 class File {
   friend class DB;
@@ -29,6 +40,10 @@ class File {
   const Status writePage(const int pageNo,
 		   const Page* pagePtr);      // write page to file
   const Status getFirstPage(int& pageNo) const;     // returns pageNo of first page
+  const Status allocatePages(const int cnt,
+		       int& firstPageNo);   // extend file by cnt pages
+  const Status writePages(const int firstPageNo, const Page* pages,
+		    const int cnt);         // write cnt consecutive pages
 
   bool operator == (const File & other) const
     {
@@ -111,6 +126,7 @@ class DB {
 
  private:
   OpenFileHashTbl   openFiles;    // list of open files
+  pthread_mutex_t   latch;        // protects openFiles and open counts
 };
 
 
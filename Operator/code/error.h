@@ -49,9 +49,11 @@ enum Status {
 
 // Utility errors
 
+       BADDATAFILE,
+
 // Query errors
 
-       ATTRTYPEMISMATCH, TMP_RES_EXISTS,
+       ATTRTYPEMISMATCH, TMP_RES_EXISTS, BADJOINGRAPH, AGGOVERFLOW,
 
 // do not touch filler -- add codes before it
 
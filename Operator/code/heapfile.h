@@ -15,6 +15,8 @@ using namespace std;
 
 extern DB db;
 
+class BloomFilter;
+
 // define if debug output wanted
 //#define DEBUGREL
 
@@ -31,6 +33,22 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		firstDirPage;	// pageNo of first page directory page
+  int		lastDirPage;	// pageNo of last page directory page
+};
+
+// The page directory of a heap file is a chain of DirPages hanging
+// off the FileHdrPage.  Together they list the page numbers of all
+// data pages in file order, so the Nth data page of a file can be
+// located without walking the nextPage chain of the data pages.
+
+const unsigned DIRENTRIES = (PAGESIZE - 2*sizeof(int)) / sizeof(int);
+
+struct DirPage
+{
+  int		nextDirPage;	// pageNo of next directory page, -1 if none
+  int		entryCnt;	// number of entries in use on this page
+  int		pageNo[DIRENTRIES]; // data page numbers
 };
 
 
@@ -58,8 +76,18 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // look up the page number of the index'th data page in the page directory
+  const Status getPageNo(const int index, int& pageNo) const;
+
+protected:
+  // append a newly allocated data page to the page directory
+  const Status appendDirEntry(const int pageNo);
 };
 
 
@@ -78,6 +106,13 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // restrict the scan to data pages [first, last) of the page directory
+    const Status setPageRange(const int first, const int last);
+
+    // in addition to the filter, skip records whose attribute at offset
+    // is not in bloom (NULL for no Bloom filter)
+    const Status setBloomFilter(const BloomFilter* bloom, const int offset);
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
@@ -100,6 +135,10 @@ private:
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    int   startPageNo;       // first page of the scan
+    int   endPageNo;         // page following the last page of the scan, -1 if EOF
+    const BloomFilter* bloom; // Bloom filter on records, NULL if none
+    int   bloomOffset;       // byte offset of the attribute bloom is on
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -123,6 +162,29 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // insert n records into file, returning their RIDs via outRids
+    // (which may be NULL)
+    const Status insertBatch(const Record* recs, const int n, RID* outRids);
+
+    // append a page of records built outside the buffer pool
+    const Status appendPage(const Page* page, const int recCnt);
+
+    // append cnt pages built outside the buffer pool, writing them
+    // straight to the file; holds recCnt records in total
+    const Status appendPages(Page* pages, const int cnt, const int recCnt);
+
+private:
+    // link a new empty page onto the end of the file
+    const Status addPage();
+
+    // insert n fixed-width records stored back to back at data
+    const Status insertFixed(const char* data, const int width, const int n,
+                             RID* outRids);
 };
 
+// create and destroy heap files
+const Status createHeapFile(const string fileName);
+const Status destroyHeapFile(const string fileName);
+
 #endif
@@ -1,40 +1,58 @@
+// hash table on the join attribute of the build relation of a hash join.
+//
+// Entries hold the RID of a build record and a copy of its join
+// attribute, and live back to back in one arena.  The buckets are a
+// flat array of entry numbers; the entries of a bucket are chained
+// through their next field.  Each entry also keeps the full hash value
+// of its key as a tag, so that keys are only compared when the tags
+// match.
 
 class joinHashTbl
 {
 private:
-    union JAttrType
+    struct joinHashEntry
     {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
-    {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
-
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
+	RID		rid;
+	int		next;	// next entry in the bucket, -1 at the end
+	unsigned int	tag;	// hash value of the key
+	char		key[1];	// join attribute value (attrLen bytes)
     };
 
     AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int		keyLen;		// length of the join attribute
+    int		entrySize;	// size of an entry including its key
+    int		*bucket;	// first entry of each bucket, -1 if empty
+    unsigned int mask;		// number of buckets - 1
+    char	*arena;		// entries, back to back
+    int		entryCnt;	// number of entries in the arena
+    int		maxEntries;	// number of entries the arena can hold
+
+    unsigned int hash(const char* attr) const;
+    bool equal(const char* key1, const char* key2) const;
+    joinHashEntry* entry(const int i) const
+	{ return (joinHashEntry*) (arena + (long) i * entrySize); }
 
 public:
+    // iterator over the entries matching a probe key
+    struct Probe
+    {
+	const char*	key;
+	unsigned int	tag;
+	int		cur;	// next entry to look at, -1 at the end
+    };
+
     joinHashTbl(const int size, const AttrDesc attr);  // constructor
     ~joinHashTbl();
 
      // insert a new (JoinAttrValue, RID) pair into hash table
      Status insert(const RID newRid,  const char* tuple);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
-};
+     // start a probe for the entries whose join attribute value matches
+     // the value at innerJoinAttrPtr, which must stay valid while the
+     // probe is in use
+     void probe(const char* innerJoinAttrPtr, Probe & p) const;
 
+     // get the RID of the next matching entry; returns false when there
+     // are no more matches.  Allocates nothing.
+     bool next(Probe & p, RID & outRid) const;
+};
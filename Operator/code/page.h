@@ -51,11 +51,17 @@ public:
 
     const Status getNextPage(int& pageNo) const; // returns value of nextPage
     const Status setNextPage(const int pageNo); // sets value of nextPage to pageNo
+    const Status setPageNo(const int pageNo); // renumbers a page copied into a file
     const short getFreeSpace() const; // returns amount of free space
 
     // inserts a new record (rec) into the page, returns RID of record 
     const Status insertRecord(const Record & rec, RID& rid);
 
+    // inserts as many as fit of n records of width bytes each that are
+    // stored back to back at recs, returns their number via cnt
+    const Status insertFixed(const char* recs, const int width, const int n,
+                             int& cnt, RID rids[]);
+
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
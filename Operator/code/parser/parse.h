@@ -40,6 +40,10 @@ typedef struct {
 #define STRCHAR   's'
 #define PROMPT	  "\n>>> "
 
+// formats of the data files read by load and written by export
+#define BINARYFILE 0
+#define CSVFILE    1
+
 
 //
 // all the available kinds of nodes
@@ -55,10 +59,13 @@ typedef enum {
     N_REBUILD,
     N_DROP,
     N_LOAD,
+    N_EXPORT,
     N_PRINT,
     N_HELP,
     N_SELECT,
     N_JOIN,
+    N_ORDER,
+    N_AGGR,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
@@ -82,6 +89,10 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    int explain;	// show the plan instead of running it
+	    struct node *order;	// order by clause, or NULL
+	    struct node *group;	// group by attributes, or NULL
+	    int distinct;	// leave out duplicate result tuples
 	} QUERY;
 
 	// insert node */
@@ -121,10 +132,12 @@ typedef struct node {
 	    char *attrname;
 	} DROP;
 
-	// load node */
+	// load and export node */
 	struct {
 	    char *relname;
 	    char *filename;
+	    int format;
+	    char *delim;
 	} LOAD;
 
 	// pprint node */
@@ -149,8 +162,24 @@ typedef struct node {
 	    struct node *joinattr1;
 	    int op;
 	    struct node *joinattr2;
+	    struct node *low;	// band join: joinattr1 between joinattr2
+	    struct node *high;	// + low and joinattr2 + high, else NULL
 	} JOIN;
 
+	// order by node */
+	struct {
+	    struct node *orderattr;
+	    int desc;		// descending instead of ascending
+	    int limit;		// keep only the first limit records, if >= 0
+	} ORDER;
+
+	// aggregate node */
+	struct {
+	    int func;		// an AggFunc
+	    struct node *aggattr; // qualified attribute; its attrname is
+				// NULL for count(*)
+	} AGGR;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -212,7 +241,7 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *order);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
@@ -220,11 +249,15 @@ NODE *destroy_node(char *relname);
 NODE *build_node(char *relname, char *attrname, int nbuckets);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
-NODE *load_node(char *relname, char *filename);
+NODE *load_node(char *relname, char *filename, int format, char *delim);
+NODE *export_node(char *relname, char *filename, int format, char *delim);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *band_node(NODE *joinattr1, NODE *joinattr2, NODE *low, NODE *high);
+NODE *order_node(NODE *orderattr, int desc, int limit);
+NODE *aggr_node(char *func, NODE *aggattr);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -6,6 +6,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "heapfile.h"
+#include "catalog.h"
+#include "query.h"
 #include "parse.h"
 
 extern "C" int isatty(int);
@@ -72,14 +74,35 @@ static NODE *parse_tree;                // root of parse tree
 		T_QSTRING
 		T_SHELL_CMD
 
+%token		RW_EXPORT
+		RW_TO
+		RW_CSV
+		RW_BINARY
+		RW_EXPLAIN
+		RW_BETWEEN
+		RW_ORDER
+		RW_BY
+		RW_ASC
+		RW_DESC
+		RW_LIMIT
+		RW_DISTINCT
+		RW_GROUP
+
 %type	<ival>	op
+		opt_format
+		format
+		opt_desc
+		opt_limit
+		opt_distinct
 
 %type	<sval>	opt_into_relname
 		opt_relname
+		opt_delim
 		string
 
 %type	<n>	command
 		query
+		explain
 		insert
 		delete
 		create
@@ -90,15 +113,22 @@ static NODE *parse_tree;                // root of parse tree
 */
 		drop
 		load
+		export
 		print
 		help
 		quit
 		opt_primary_attr
 		opt_where
+		opt_order
+		opt_group
 		qual
 		selection
 		join
+		join_list
+		offset
 		non_mt_qualattr_list
+		non_mt_selattr_list
+		selattr
 		qualattr
 /*
 		non_mt_attrval_list
@@ -143,6 +173,7 @@ start
 
 command
 	: query
+	| explain
 	| insert
 	| delete
 	| create
@@ -153,6 +184,7 @@ command
 */
 	| drop
 	| load
+	| export
 	| print
 	| help
 	| quit
@@ -163,26 +195,61 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT opt_distinct non_mt_selattr_list opt_into_relname RW_FROM table_list opt_where opt_group opt_order
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
-		NODE *where;
-		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
-		if (qualattr_list == NULL) { // something wrong in qualattr_list
-		  $$ = NULL;
+		NODE *where, *group = NULL;
+		NODE *qualattr_list = replace_alias_in_qualattr_list($6, $3);
+		if ($8 != NULL)
+		  group = replace_alias_in_qualattr_list($6, $8);
+		if (qualattr_list == NULL || (group == NULL && $8 != NULL)) {
+		  $$ = NULL; // something wrong in qualattr_list
 		}
 		else {
-		  where = replace_alias_in_condition($5, $6);
-		  if ((where == NULL) && ($6 != NULL)) {
+		  where = replace_alias_in_condition($6, $7);
+		  if ((where == NULL) && ($7 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($4, qualattr_list, where, $9);
+		    $$->u.QUERY.distinct = $2;
+		    $$->u.QUERY.group = group;
 		  }
 		}
 	}
 	;
 
+opt_distinct
+	: RW_DISTINCT
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_group
+	: RW_GROUP RW_BY non_mt_qualattr_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+explain
+	: RW_EXPLAIN query
+	{
+		$$ = $2;
+		if ($$ != NULL)
+		  $$->u.QUERY.explain = 1;
+	}
+	;
+
 table_list
 	: '(' table_list ')'
 	{
@@ -297,9 +364,46 @@ drop
 	;
 
 load
-	: RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')'
+	: RW_LOAD RW_TABLE string RW_FROM opt_format '(' T_QSTRING opt_delim ')'
+	{
+		$$ = load_node($3, $7, $5, $8);
+	}
+	;
+
+export
+	: RW_EXPORT RW_TABLE string RW_TO format '(' T_QSTRING opt_delim ')'
 	{
-		$$ = load_node($3, $6);
+		$$ = export_node($3, $7, $5, $8);
+	}
+	;
+
+opt_format
+	: format
+	| nothing
+	{
+		$$ = BINARYFILE;
+	}
+	;
+
+format
+	: RW_CSV
+	{
+		$$ = CSVFILE;
+	}
+	| RW_BINARY
+	{
+		$$ = BINARYFILE;
+	}
+	;
+
+opt_delim
+	: ',' T_QSTRING
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = NULL;
 	}
 	;
 print
@@ -367,9 +471,65 @@ opt_where
 	}
 	;
 
+opt_order
+	: RW_ORDER RW_BY qualattr opt_desc opt_limit
+	{
+		$$ = order_node($3, $4, $5);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_desc
+	: RW_ASC
+	{
+		$$ = 0;
+	}
+	| RW_DESC
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		if ($2 < 0) {
+		  fprintf(stderr, "Error: limit must not be negative\n");
+		  YYERROR;
+		}
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 qual
 	: selection
 	| join
+	| join RW_AND join_list
+	{
+		$$ = prepend($1, $3);
+	}
+	;
+
+join_list
+	: join RW_AND join_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| join
+	{
+		$$ = list_node($1);
+	}
 	;
 
 selection
@@ -384,6 +544,40 @@ join
 	{
 		$$ = join_node($1, $2, $3);
 	}
+	| qualattr RW_BETWEEN qualattr offset RW_AND qualattr offset
+	{
+		// a band join: both bounds must be on the same attribute
+		if (strcmp($3->u.QUALATTR.attrname, $6->u.QUALATTR.attrname) ||
+		    ($3->u.QUALATTR.relname == NULL) !=
+		    ($6->u.QUALATTR.relname == NULL) ||
+		    ($3->u.QUALATTR.relname &&
+		     strcmp($3->u.QUALATTR.relname, $6->u.QUALATTR.relname))) {
+		  fprintf(stderr, "Error: both bounds of between must be ");
+		  fprintf(stderr, "on the same attribute\n");
+		  YYERROR;
+		}
+		$$ = band_node($1, $3, $4, $7);
+	}
+	;
+
+offset
+	: '+' value
+	{
+		$$ = $2;
+	}
+	| '-' value
+	{
+		$$ = $2;
+		if ($$->u.VALUE.type == INTEGER)
+		  $$->u.VALUE.u.ival = -$$->u.VALUE.u.ival;
+		else if ($$->u.VALUE.type == FLOAT)
+		  $$->u.VALUE.u.rval = -$$->u.VALUE.u.rval;
+	}
+	| value
+	| nothing
+	{
+		$$ = int_node(0);
+	}
 	;
 
 non_mt_qualattr_list
@@ -401,6 +595,35 @@ non_mt_qualattr_list
 	}
 	;
 
+non_mt_selattr_list
+	: '(' non_mt_selattr_list ')'
+	{
+		$$ = $2;
+	}
+	| selattr ',' non_mt_selattr_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| selattr
+	{
+		$$ = list_node($1);
+	}
+	;
+
+selattr
+	: qualattr
+	| string '(' qualattr ')'
+	{
+		if (($$ = aggr_node($1, $3))->u.AGGR.func == NoAgg)
+		  fprintf(stderr, "Error: unknown aggregate function %s\n", $1);
+	}
+	| string '(' '*' ')'
+	{
+		if (($$ = aggr_node($1, NULL))->u.AGGR.func == NoAgg)
+		  fprintf(stderr, "Error: only count takes *\n");
+	}
+	;
+
 qualattr
 	: string '.' string
 	{
@@ -78,7 +78,20 @@
      T_REAL = 294,
      T_STRING = 295,
      T_QSTRING = 296,
-     T_SHELL_CMD = 297
+     T_SHELL_CMD = 297,
+     RW_EXPORT = 298,
+     RW_TO = 299,
+     RW_CSV = 300,
+     RW_BINARY = 301,
+     RW_EXPLAIN = 302,
+     RW_BETWEEN = 303,
+     RW_ORDER = 304,
+     RW_BY = 305,
+     RW_ASC = 306,
+     RW_DESC = 307,
+     RW_LIMIT = 308,
+     RW_DISTINCT = 309,
+     RW_GROUP = 310
    };
 #endif
 /* Tokens.  */
@@ -122,6 +135,19 @@
 #define T_STRING 295
 #define T_QSTRING 296
 #define T_SHELL_CMD 297
+#define RW_EXPORT 298
+#define RW_TO 299
+#define RW_CSV 300
+#define RW_BINARY 301
+#define RW_EXPLAIN 302
+#define RW_BETWEEN 303
+#define RW_ORDER 304
+#define RW_BY 305
+#define RW_ASC 306
+#define RW_DESC 307
+#define RW_LIMIT 308
+#define RW_DISTINCT 309
+#define RW_GROUP 310
 
 
 
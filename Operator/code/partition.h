@@ -1,12 +1,15 @@
 #ifndef PARTITION_H
 #define PARTITION_H
 
-#include "heapfile.h"
+#include "spill.h"
 
 
 // define if debug output wanted
 //#define DEBUGPART
 
+// default memory for the blocks of the partitions being written
+#define PARTMEM (64 * PAGESIZE)
+
 
 class Partition {
  public:
@@ -14,16 +17,56 @@ class Partition {
 	    const string & fileName,             // (base) name of heap file
 	    const int P,                      // number of partitions
 	    const int (*hashfcn)(const Record & rec,
-				 const int P),  
+				 const int P,
+				 void *arg),
 	                               // hash function to use in partitioning
-	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    void *arg,                  // passed on to every call of hashfcn
+	    string* &partName,           // names of partition spill files
+	    Status &status,             // create partitions of file
+	    const int memBytes = PARTMEM); // memory for output blocks
+  Partition(const string & fileName,        // (base) name of heap file
+	    const int P,                      // number of partitions
+	    string* &partName,           // names of partition spill files
+	    Status &status,             // create empty partitions
+	    const int memBytes = PARTMEM); // memory for output blocks
   ~Partition();                         // destroy partitions
 
+  Status insert(const int p,
+		const Record & rec);    // add rec to partition p
+  Status close();                       // write out buffered records
+
+  int getRecCnt(const int p) const      // # of records in partition p
+  { return recCnt[p]; }
+  long getByteCnt(const int p) const    // # of bytes of its records
+  { return byteCnt[p]; }
+  int getPassCnt() const                // # of times records are written
+  { return passCnt(P, memBytes); }
+
+  // number of passes it takes to write P partitions in memBytes, and
+  // number of partitions written in one pass
+  static int passCnt(const int P, const int memBytes);
+  static int maxFiles(const int memBytes);
+
  private:
+  Status create(const string & fileName); // create the output files
+  Status split(const string & name,     // split a group file into the
+	       const int lo,            // partitions [lo, hi)
+	       const int hi);
+  string groupName();                   // name of a new group file
 
   int P;                                // number of partitions
+  int memBytes;                         // memory for output blocks
+  string baseName;                      // directory and base file name
   string *partName;                      // partition names
+  bool *made;                           // partition file created?
+  int *recCnt;                          // size of each partition
+  long *byteCnt;
+  SpillFile **out;                      // open partition or group files
+  string *outName;                      // their names
+  int outCnt;                           // # of them
+  int fan;                              // # of partitions per group file
+  int groupCnt;                         // # of group files made
+  vector<char> tagged;                  // record tagged with its partition
 };
 
 #endif
@@ -3,7 +3,11 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+// AutoJoin picks the join method with the lowest estimated cost
+enum JoinType {NLJoin, SMJoin, HashJoin, AutoJoin};
+
+// aggregate functions of QU_Aggregate; NoAgg marks a group attribute
+enum AggFunc {NoAgg, CountAll, Count, Sum, Avg, Min, Max};
 
 //
 // Prototypes for query layer functions
@@ -24,6 +28,54 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+// join on attr1 between attr2 + low and attr2 + high
+const Status QU_Band_Join(const string & result, 
+			  const int projCnt, 
+			  const attrInfo projNames[],
+			  const attrInfo *attr1, 
+			  const attrInfo *attr2,
+			  const char *low,
+			  const char *high);
+
+// print the estimated costs of the join methods for a join and the one
+// QU_Join would use
+const Status QU_Explain(const attrInfo *attr1, 
+			const Operator op, 
+			const attrInfo *attr2);
+
+// equi-join of several relations on the joinCnt conditions
+// joinAttrs[2 * i] = joinAttrs[2 * i + 1]
+const Status QU_Multi_Join(const string & result,
+			   const int projCnt,
+			   const attrInfo projNames[],
+			   const int joinCnt,
+			   const attrInfo joinAttrs[]);
+
+// print the join order QU_Multi_Join would use
+const Status QU_Multi_Explain(const int joinCnt,
+			      const attrInfo joinAttrs[]);
+
+// copy the records of relation source to relation result in order of
+// attribute attr, descending if desc, and only the first limit of them
+// unless limit is negative
+const Status QU_Order(const string & source,
+		      const string & result,
+		      const attrInfo *attr,
+		      const bool desc,
+		      const int limit);
+
+// insert a tuple for each group of the records of relation source with
+// the same values of the groupCnt attributes groupNames into relation
+// result, whose attributes are projNames: a group attribute where
+// aggs[i] is NoAgg, else aggregate aggs[i] of attribute projNames[i]
+const Status QU_Aggregate(const string & source,
+			  const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const AggFunc aggs[],
+			  const int groupCnt,
+			  const attrInfo groupNames[]);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
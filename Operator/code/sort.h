@@ -1,21 +1,27 @@
 #ifndef SORT_H
 #define SORT_H
 
-#include "heapfile.h"
+#include "spill.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// SORTREC is an in-memory sort record that sortItems sorts.
+// It points to a copy of the whole record in the sort arena
+// and to the sort attribute within it, so that sorted runs
+// are written from memory without going back to the source.
+// key is the sort attribute (or the first 8 bytes of a string)
+// turned into an unsigned number that orders like it.
 
 typedef struct {
-  RID rid;                              // record id of current record
+  unsigned long long key;               // normalized sort key
+  char* data;                           // record in the arena
+  int recLen;                           // length of record
   char* field;                          // pointer to field
   int length;                           // length of field
+  int run;                              // run the record goes to, for
+                                        // replacement selection
 } SORTREC;
 
 
@@ -24,40 +30,131 @@ class SortedFile {
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int memBytes, Status& status,
+	     bool replace = false,      // make runs by replacement selection
+	     int threads = 1,           // # of threads making/merging runs
+	     bool sorted = false);      // source known to be in sort order
+
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
   Status gotoMark();                    // go to last recorded spot
   ~SortedFile();                        // destroy temporary structures / files
 
+  int getRunCnt() const                 // # of runs the source was split into
+  { return sourceRuns; }
+
+  // is file in order of the attribute? (one scan if it is, usually a
+  // few records if not)
+  static Status isSorted(const string & fileName, int offset, int length,
+			 Datatype type, bool & sorted);
+
+  // sort kernels, also used by keybench
+  static void makeKey(SORTREC & item, Datatype type); // set item.key
+  static void sortItems(SORTREC* items, int cnt,      // sort by key and
+			Datatype type);               // attribute
+
  private:
-  Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
-  Status startScans();                  // start a scan on each sorted run
+  // Runs are spill files, except for a source in sort order, which
+  // is scanned as the only run.
 
   typedef struct {
     string name;                        // name of run file
-    HeapFileScan* inFile;               // ptr to input file
-    InsertFileScan* outFile;		// ptr to output file
+    HeapFileScan* inFile;               // scan of a presorted source
+    SpillScan* scan;                    // scan of a run file
+    SpillFile* outFile;                 // run file being written
     int valid;                          // TRUE if recPtr has a record
     Record rec;
-    RID rid;                            // RID of current record of run
-    RID mark;
+    bool done;                          // no current record in range
+    bool markDone;
   } RUN;
 
+  // A worker makes the runs of the data pages [firstPage, lastPage)
+  // of the source in an arena of its own, and keeps a sample of the
+  // sort attributes written to them. Workers run in threads of their
+  // own if there are several.
+
+  typedef struct {
+    SortedFile* sort;
+    pthread_t thread;
+    int firstPage;
+    int lastPage;
+    char* arena;                        // copies of the source records
+    int memBytes;                       // size of arena in bytes
+    vector<SORTREC> buffer;             // in-memory sort buffer
+    vector<RUN> runs;                   // runs made by the worker
+    vector<char> samples;               // sampled sort attributes
+    int written;                        // # of records written to runs
+    Status status;
+  } WORKER;
+
+  // A range merge merges the records in [lo, hi) of all runs into
+  // out. lo or hi is NULL if the range is open at that end.
+
+  typedef struct {
+    SortedFile* sort;
+    pthread_t thread;
+    const char* lo;
+    const char* hi;
+    RUN out;
+    Status status;
+  } RANGE;
+
+  SortedFile(const SortedFile & src,    // merge the runs of src that
+	     const char* lo,            // are in [lo, hi)
+	     const char* hi, Status& status);
+
+  Status sortFile();                    // split source file into sub-runs
+  Status makeRuns(vector<char> & samples); // make runs with the workers
+  static void* runWorker(void* arg);    // thread of a worker
+  Status generateRun(WORKER & w);       // generate one sub-run of file
+  void copyRecord(SORTREC & item, char* slot, const Record & rec);
+                                        // copy rec into slot of arena
+  Status sortRuns(WORKER & w);          // generate sub-runs by sorting
+  Status selectRuns(WORKER & w);        // generate sub-runs with a heap
+  Status newRun(WORKER & w);            // create the file of a new run
+  void sample(WORKER & w, const char* field); // sample written field
+  bool heapLess(WORKER & w, int i, int j); // buffer[i] before buffer[j]?
+  void siftDown(WORKER & w, int i, int items); // restore heap order
+  Status mergeRuns(int cnt);            // merge the first cnt runs
+  Status mergeRanges(int ranges, const vector<char> & samples);
+                                        // merge runs by key ranges
+  static void* rangeWorker(void* arg);  // thread of a range merge
+  string runName();                     // name of a new run file
+  Status startScans();                  // start a scan on each sorted run
+  Status seek(int r);                   // go to the first record >= lo
+  Status fetch(int r);                  // read the next record of run r
+  bool before(int r1, int r2);          // run r1's record comes first?
+  void buildTree();                     // set up the tree of losers
+
   vector<RUN> runs;                   // holds info about each sub-run
 
-  HeapFile* hfile;                   // source file to sort
-  HeapFileScan* hfs;                   // source file to sort
+  // Tournament tree of losers over the current records of the runs:
+  // tree[0] is the run with the smallest record, and each inner node
+  // holds the run that lost the match there. Run r is leaf
+  // runs.size() + r; the parent of node t is t / 2.
+
+  vector<int> tree;
+  bool treeBuilt;                       // false until the first next()
+  vector<int> markTree;                 // tree at the last setMark()
+  bool markBuilt;
+
   string fileName;                      // name of source file to sort
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
-
-  SORTREC* buffer;                      // in-memory sort buffer
-  int maxItems;                         // max. # of items/tuples in buffer
-  int numItems;                         // current # of items in buffer
+  bool presorted;                       // source file used as only run
+  int runCnt;                           // number of run files made
+  int sourceRuns;                       // number of runs made from source
+  bool replace;                         // runs by replacement selection
+  int threads;                          // # of workers and range merges
+  int memBytes;                         // memory of all workers in bytes
+  int blockSize;                        // size of the blocks of runs
+  bool borrowed;                        // runs belong to another sort
+  bool ranged;                          // runs hold ascending key ranges
+  const char* lo;                       // records before lo are skipped,
+  const char* hi;                       // from hi on too (NULL if none)
+  pthread_mutex_t latch;                // protects runCnt
 };
 
 #endif
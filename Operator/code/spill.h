@@ -0,0 +1,114 @@
+#ifndef SPILL_H
+#define SPILL_H
+
+#include "heapfile.h"
+
+
+// Spill files hold temporary records (sorted runs, partitions) outside
+// of the database. They are written once, front to back, and read
+// sequentially, a block of many pages at a time, with plain Unix I/O:
+// they never enter the buffer pool, have no slotted pages or page
+// directory, and allocate nothing per page.
+//
+// A spill file is a header followed by blocks of the same size. A
+// block holds the number of records in it, then each record as its
+// length and its bytes; a record never spans blocks. The header,
+// written when the file is closed, gives the block size and the
+// number of blocks and records.
+
+// default size of a block
+#define SPILLBLOCK (32 * PAGESIZE)
+
+
+// I/O done on spill files, in pages of PAGESIZE bytes so that it can
+// be compared with the disk reads and writes of the buffer pool
+
+struct SpillStats
+{
+  int pagereads;
+  int pagewrites;
+
+  void clear() { pagereads = pagewrites = 0; }
+  SpillStats() { clear(); }
+};
+
+extern SpillStats spillStats;
+
+// directory of temporary spill files such as the partitions of a hash
+// join; /tmp unless set with minirel -s
+extern const char* SpillDir;
+
+
+// Appends records to a new spill file.
+
+class SpillFile {
+ public:
+  SpillFile(const string & fileName,    // create fileName, which must
+	    Status & status,            // not exist yet
+	    const int blockSize = SPILLBLOCK);
+  ~SpillFile();                         // close if not closed yet
+
+  Status append(const Record & rec);    // add rec at the end
+  Status close();                       // write last block and header
+  int getRecCnt() const { return recCnt; }
+
+ private:
+  Status writeBlock();                  // write out the current block
+
+  int fd;                               // Unix file, -1 once closed
+  int blockSize;
+  char* block;                          // block being filled
+  int used;                             // bytes used in block
+  int blockRecs;                        // # of records in block
+  int blockCnt;                         // # of blocks written
+  int recCnt;                           // # of records appended
+};
+
+
+// Sequential scan of a closed spill file.
+
+class SpillScan {
+ public:
+  SpillScan(const string & fileName, Status & status);
+  ~SpillScan();
+
+  int getRecCnt() const { return recCnt; }
+  int getBlockCnt() const { return blockCnt; }
+  long getByteCnt() const;              // size of the file
+
+  Status scanNext(Record & rec);        // next record, FILEEOF at end
+  Status getRecord(Record & rec);       // current record again
+  Status setBlock(const int b);         // go on with the first record
+					// of block b
+  Status getBlock(const int b,          // all records of block b, valid
+		  vector<Record> & recs); // until the next read
+  Status markScan();                    // save current position
+  Status resetScan();                   // go back to the saved position
+
+ private:
+  Status readBlock(const int b);        // bring block b into memory
+
+  int fd;
+  int blockSize;
+  int blockCnt;                         // # of blocks in the file
+  int recCnt;                           // # of records in the file
+  char* block;                          // block in memory
+  int blockNo;                          // its number, -1 if none
+  char* held;                           // block of the saved position,
+  int heldNo;                           // kept while the scan goes on
+  int start;                            // block to start at when there
+					// is no current record
+  int left;                             // records after cur in block
+  int cur;                              // offset of current record, -1
+					// if none
+  int markBlockNo;                      // position saved by markScan()
+  int markStart;
+  int markLeft;
+  int markCur;
+};
+
+
+// remove a spill file
+const Status destroySpillFile(const string & fileName);
+
+#endif
@@ -25,6 +25,15 @@ using namespace std;
 const Status UT_Load(const string & relation, 
 		     const string & fileName);
 
+const Status UT_LoadCSV(const string & relation,
+			const string & fileName,
+			const char delim);
+
+const Status UT_Export(const string & relation,
+		       const string & fileName,
+		       const bool csv,
+		       const char delim);
+
 const Status UT_Print(string relation);
 
 void   UT_Quit(void);